@@ -552,6 +552,7 @@ class FuncDeclaration : public Declaration
 {
 public:
     Statement *fbody;
+    DString lazyBody;                   // source of fbody until parsed by parseLazyBody()
 
     FuncDeclarations foverrides;        // functions this function overrides
 
@@ -731,6 +732,7 @@ public:
     Expressions *fdensureParams(Expressions *fdep);
     bool functionSemantic();
     bool functionSemantic3();
+    void parseLazyBody();
     bool equals(const RootObject * const o) const override final;
 
     int findVtblIndex(Dsymbols *vtbl, int dim);
@@ -152,6 +152,7 @@ struct Verbose
     // collect and list statistics on template instantiations origins.
     // TODO: make this an enum when we want to list other kinds of instances
     d_bool templatesListInstances;
+    d_bool templatesLookups;  // also report the cost of looking up existing instances
     d_bool gc;                 // identify gc usage
     d_bool field;              // identify non-mutable field variables
     d_bool complex = true;     // identify complex/imaginary type usage
@@ -258,6 +259,9 @@ struct Param
 
     unsigned debuglevel;   // debug level
     unsigned versionlevel; // version level
+    unsigned jobs;         // number of threads to parse the root modules with
+    d_bool lazyBodies;     // parse function bodies of imported modules on demand
+    d_bool binaryHeaders;  // write 'header' files as binary `.dio` files
 
     d_bool run;           // run resulting executable
     Strings runargs;    // arguments for executable
@@ -344,6 +348,7 @@ const DString doc_ext  = "html";     // for Ddoc generated files
 const DString ddoc_ext = "ddoc";     // for Ddoc macro include files
 const DString dd_ext   = "dd";       // for Ddoc source files
 const DString hdr_ext  = "di";       // for D 'header' import files
+const DString dio_ext  = "dio";      // for binary D 'header' import files
 const DString json_ext = "json";     // for JSON files
 const DString map_ext  = "map";      // for .map files
 const DString c_ext    = "c";        // for C source files
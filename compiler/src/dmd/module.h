@@ -91,6 +91,7 @@ public:
     ThreeState rootimports;
     void* tagSymTab;            // ImportC: tag symbols that conflict with other symbols used as the index
     OutBuffer defines;          // collect all the #define lines here
+    void* parseErrors;          // if parsed by parseParallel(), its diagnostics not reported yet
     bool selfImports();         // returns true if module imports itself
 
     bool rootImports();         // returns true if module imports root module
@@ -137,6 +138,7 @@ public:
     static void runDeferredSemantic2();
     static void runDeferredSemantic3();
     int imports(Module *m);
+    bool releaseBodies(DArray<Module *> pending); // drop function bodies after codegen
 
     bool isRoot() { return this->importedFrom == this; }
     // true if the module source file is directly
@@ -274,6 +274,7 @@ public:
     TemplateInstance *inst;             // refer to existing instance
     ScopeDsymbol *argsym;               // argument symbol table
     hash_t hash;                        // cached result of toHash()
+    DArray<const void*> argKeys;        // argumentKeys(tdtypes) set by toHash(), null if there are none
     Expressions *fargs;                 // for function template, these are the function arguments
 
     TemplateInstances* deferred;
@@ -25,11 +25,21 @@
 // The hash depends on the IR code (obviously), but also on the compiler+LLVM
 // versions and several compile flags (e.g. -O*, -mcpu, and -mattr).
 //
+// With -cache-template-instances, the cache directory also holds an index of
+// the template instances defined by each object file (tiindex_<hash>.txt, the
+// hash being the one of the object file path). The index also holds the hash
+// of the object file's contents, an index whose object file changed since is
+// ignored. Other compilations then emit these instances available_externally
+// instead of defining them again. Cached object files keep their list of
+// instances in ircache_<hash>.tinst, to restore the index on a cache hit.
+//
 //===----------------------------------------------------------------------===//
 
 #include "driver/cache.h"
 
 #include "dmd/errors.h"
+#include "dmd/globals.h"
+#include "dmd/module.h"
 #include "dmd/target.h"
 #include "driver/cache_pruning.h"
 #include "driver/cl_options.h"
@@ -38,13 +48,19 @@
 #include "gen/logger.h"
 #include "gen/optimizer.h"
 
+#include "llvm/ADT/StringMap.h"
+#include "llvm/ADT/StringSet.h"
 #include "llvm/Bitcode/BitcodeWriter.h"
+#include "llvm/IR/Module.h"
 #include "llvm/Support/Chrono.h"
 #include "llvm/Support/FileSystem.h"
 #include "llvm/Support/MD5.h"
+#include "llvm/Support/MemoryBuffer.h"
 #include "llvm/Support/Path.h"
 #include "llvm/Support/raw_ostream.h"
 
+#include <vector>
+
 // Include close() declaration.
 #if !defined(_MSC_VER) && !defined(__MINGW32__)
 #include <unistd.h>
@@ -161,6 +177,14 @@ llvm::cl::opt<RetrievalMode> cacheRecoveryMode(
         clEnumValN(RetrievalMode::SymLink, "symlink",
                    "Create a symbolic link to the cache file")));
 
+llvm::cl::opt<bool> cacheTemplateInstances(
+    "cache-template-instances", llvm::cl::ZeroOrMore,
+    llvm::cl::desc("Record the template instances defined by each object file "
+                   "in the cache directory, and only emit the ones defined by "
+                   "other object files available_externally. All object "
+                   "files compiled with this option must be linked "
+                   "together, use a separate cache directory per program."));
+
 bool isPruningEnabled() {
   if (pruneEnabled)
     return true;
@@ -335,6 +359,186 @@ void outputIR2ObjRelevantCmdlineArgs(llvm::raw_ostream &hash_os) {
 #endif
 }
 
+void makeAbsolutePath(llvm::StringRef path, llvm::SmallString<128> &result) {
+  result = path;
+  llvm::sys::fs::make_absolute(result);
+  llvm::sys::path::remove_dots(result, /*remove_dot_dot=*/true);
+}
+
+void storeTemplateIndexFileName(llvm::StringRef objectFile,
+                                llvm::SmallString<128> &filePath) {
+  llvm::MD5 hasher;
+  hasher.update(objectFile);
+  llvm::MD5::MD5Result result;
+  hasher.final(result);
+  llvm::SmallString<32> hash;
+  llvm::MD5::stringifyResult(result, hash);
+
+  filePath = opts::cacheDir;
+  llvm::sys::path::append(filePath, llvm::Twine("tiindex_") + hash + ".txt");
+}
+
+void createCacheDir() {
+  if (llvm::sys::fs::exists(opts::cacheDir))
+    return;
+  if (auto errorcode = llvm::sys::fs::create_directories(opts::cacheDir)) {
+    error(Loc(), "Unable to create cache directory: %s (errno %d: %s)",
+          opts::cacheDir.c_str(), errorcode.value(),
+          errorcode.message().c_str());
+    fatal();
+  }
+}
+
+/// Stores the MD5 hash of the contents of file `path` in `hash`. Returns false
+/// if the file cannot be read.
+bool hashFileContents(llvm::StringRef path, llvm::SmallString<32> &hash) {
+  auto buffer = llvm::MemoryBuffer::getFile(path);
+  if (!buffer)
+    return false;
+  llvm::MD5 hasher;
+  hasher.update((*buffer)->getBuffer());
+  llvm::MD5::MD5Result result;
+  hasher.final(result);
+  llvm::MD5::stringifyResult(result, hash);
+  return true;
+}
+
+/// An object file listed in a template instance index, with the hash of its
+/// contents at the time the index was written.
+struct IndexedObject {
+  std::string path;
+  std::string hash;
+  enum { Unverified, Valid, Stale } state = Unverified;
+};
+
+/// Maps the mangled names of template instances to the object file defining
+/// them, an index into `indexedObjects`. Loaded on first use.
+llvm::StringMap<size_t> templateIndex;
+std::vector<IndexedObject> indexedObjects;
+bool templateIndexLoaded = false;
+
+void loadTemplateIndex() {
+  templateIndexLoaded = true;
+  if (!llvm::sys::fs::exists(opts::cacheDir))
+    return;
+
+  // The object files written by this compilation are about to change, don't
+  // rely on what they defined before.
+  llvm::StringSet<> ownObjectFiles;
+  llvm::SmallString<128> path;
+  for (auto m : Module::amodules) {
+    if (m->isRoot()) {
+      makeAbsolutePath(m->objfile.toChars(), path);
+      ownObjectFiles.insert(path);
+    }
+  }
+  if (global.params.oneobj && global.params.objfiles.length) {
+    makeAbsolutePath(global.params.objfiles[0], path);
+    ownObjectFiles.insert(path);
+  }
+
+  std::error_code ec;
+  for (llvm::sys::fs::directory_iterator it(opts::cacheDir, ec), end;
+       it != end && !ec; it.increment(ec)) {
+    const auto indexFile = it->path();
+    if (!llvm::sys::path::filename(indexFile).startswith("tiindex_"))
+      continue;
+
+    auto buffer = llvm::MemoryBuffer::getFile(indexFile);
+    if (!buffer)
+      continue;
+    llvm::StringRef contents = (*buffer)->getBuffer();
+    llvm::StringRef objectFile, objectHash;
+    std::tie(objectFile, contents) = contents.split('\n');
+    std::tie(objectHash, contents) = contents.split('\n');
+    if (objectHash.empty() || ownObjectFiles.count(objectFile))
+      continue;
+
+    const size_t object = indexedObjects.size();
+    indexedObjects.push_back({objectFile.str(), objectHash.str()});
+    while (!contents.empty()) {
+      llvm::StringRef mangle;
+      std::tie(mangle, contents) = contents.split('\n');
+      if (!mangle.empty())
+        templateIndex.try_emplace(mangle, object);
+    }
+  }
+  IF_LOG Logger::println("Loaded %u template instances from the cache index",
+                         templateIndex.size());
+}
+
+/// Returns whether the object file is still the one its index was written for.
+/// The contents are compared rather than the modification time, which is
+/// unreliable for object files recovered from the cache as links.
+bool isIndexedObjectValid(IndexedObject &object) {
+  if (object.state == IndexedObject::Unverified) {
+    llvm::SmallString<32> hash;
+    object.state = hashFileContents(object.path, hash) && hash == object.hash
+                       ? IndexedObject::Valid
+                       : IndexedObject::Stale;
+    IF_LOG if (object.state == IndexedObject::Stale) Logger::println(
+        "Stale template instance index for %s", object.path.c_str());
+  }
+  return object.state == IndexedObject::Valid;
+}
+
+/// Writes `contents` to `file` atomically, like the cached object files.
+void writeCacheFileAtomically(llvm::StringRef file, llvm::StringRef contents) {
+  int FD;
+  llvm::SmallString<128> tempFile;
+  if (auto errorcode = llvm::sys::fs::createUniqueFile(
+          llvm::Twine(file) + ".tmp%%%%%%%", FD, tempFile)) {
+    error(Loc(),
+          "Could not create temporary file in the cache (errno %d: %s)",
+          errorcode.value(), errorcode.message().c_str());
+    fatal();
+  }
+
+  {
+    llvm::raw_fd_ostream os(FD, /*shouldClose=*/true);
+    os << contents;
+  }
+
+  IF_LOG Logger::println("Rename temp file to cache file: %s to %s",
+                         tempFile.c_str(), file.str().c_str());
+  if (auto errorcode = llvm::sys::fs::rename(tempFile.c_str(), file)) {
+    error(Loc(),
+          "Failed to rename temp file to cache file: %s to %s (errno %d: %s)",
+          tempFile.c_str(), file.str().c_str(), errorcode.value(),
+          errorcode.message().c_str());
+    fatal();
+  }
+}
+
+/// Writes the template instance index of `objectFile`, which defines the
+/// instances listed in `instances` (one per line).
+void writeTemplateIndex(llvm::StringRef objectFile,
+                        llvm::StringRef instances) {
+  llvm::SmallString<128> objectPath;
+  makeAbsolutePath(objectFile, objectPath);
+  llvm::SmallString<128> indexFile;
+  storeTemplateIndexFileName(objectPath, indexFile);
+
+  llvm::SmallString<32> objectHash;
+  if (!hashFileContents(objectPath, objectHash)) {
+    llvm::sys::fs::remove(indexFile);
+    return;
+  }
+
+  std::string contents;
+  llvm::raw_string_ostream os(contents);
+  os << objectPath << '\n' << objectHash << '\n' << instances;
+  os.flush();
+  writeCacheFileAtomically(indexFile, contents);
+}
+
+void storeTemplateListFileName(llvm::StringRef cacheObjectHash,
+                               llvm::SmallString<128> &filePath) {
+  filePath = opts::cacheDir;
+  llvm::sys::path::append(filePath, llvm::Twine("ircache_") +
+                                        cacheObjectHash + ".tinst");
+}
+
 // Output to `hash_os` all environment flags that influence object code output
 // in ways that are not observable in the pre-LLVM passes IR used for hashing.
 void outputIR2ObjRelevantEnvironmentOpts(llvm::raw_ostream &hash_os) {
@@ -388,14 +592,7 @@ void cacheObjectFile(llvm::StringRef objectFile,
   if (opts::cacheDir.empty())
     return;
 
-  if (!llvm::sys::fs::exists(opts::cacheDir)) {
-    if (auto errorcode = llvm::sys::fs::create_directories(opts::cacheDir)) {
-      error(Loc(), "Unable to create cache directory: %s (errno %d: %s)",
-            opts::cacheDir.c_str(), errorcode.value(),
-            errorcode.message().c_str());
-      fatal();
-    }
-  }
+  createCacheDir();
 
   // To prevent bad cache files, add files to the cache atomically: first copy
   // to a temporary file and then rename that temp file to the cache entry
@@ -521,6 +718,76 @@ void recoverObjectFile(llvm::StringRef cacheObjectHash,
   }
 }
 
+bool isTemplateInstanceCached(llvm::StringRef mangle) {
+  if (!cacheTemplateInstances || opts::cacheDir.empty())
+    return false;
+
+  if (!templateIndexLoaded)
+    loadTemplateIndex();
+
+  auto it = templateIndex.find(mangle);
+  if (it == templateIndex.end())
+    return false;
+
+  auto &object = indexedObjects[it->second];
+  if (!isIndexedObjectValid(object))
+    return false;
+
+  IF_LOG Logger::println("Template instance %s is defined in %s",
+                         mangle.str().c_str(), object.path.c_str());
+  return true;
+}
+
+void recordTemplateInstances(llvm::Module &m, llvm::StringRef objectFile,
+                             llvm::StringRef cacheObjectHash) {
+  if (!cacheTemplateInstances || opts::cacheDir.empty())
+    return;
+
+  createCacheDir();
+
+  // Template instances are the only functions with ODR linkage. The
+  // linkonce_odr ones still defined after optimization are in the object
+  // file as well.
+  std::string instances;
+  llvm::raw_string_ostream os(instances);
+  for (const auto &func : m.functions()) {
+    if (!func.isDeclaration() &&
+        (func.hasWeakODRLinkage() || func.hasLinkOnceODRLinkage()))
+      os << func.getName() << '\n';
+  }
+  os.flush();
+
+  // Keep the list with the cached object file, for recoverTemplateInstances.
+  if (!cacheObjectHash.empty()) {
+    llvm::SmallString<128> listFile;
+    storeTemplateListFileName(cacheObjectHash, listFile);
+    writeCacheFileAtomically(listFile, instances);
+  }
+
+  writeTemplateIndex(objectFile, instances);
+}
+
+void recoverTemplateInstances(llvm::StringRef cacheObjectHash,
+                              llvm::StringRef objectFile) {
+  if (!cacheTemplateInstances)
+    return;
+
+  llvm::SmallString<128> listFile;
+  storeTemplateListFileName(cacheObjectHash, listFile);
+  auto buffer = llvm::MemoryBuffer::getFile(listFile);
+  if (!buffer) {
+    // Cached without -cache-template-instances or pruned, so the instances
+    // of the object file are unknown. Don't leave an outdated index behind.
+    llvm::SmallString<128> objectPath, indexFile;
+    makeAbsolutePath(objectFile, objectPath);
+    storeTemplateIndexFileName(objectPath, indexFile);
+    llvm::sys::fs::remove(indexFile);
+    return;
+  }
+
+  writeTemplateIndex(objectFile, (*buffer)->getBuffer());
+}
+
 void pruneCache() {
   if (!opts::cacheDir.empty() && isPruningEnabled()) {
     ::pruneCache(opts::cacheDir.data(), opts::cacheDir.size(), pruneInterval,
@@ -26,6 +26,19 @@ void cacheObjectFile(llvm::StringRef objectFile,
 void recoverObjectFile(llvm::StringRef cacheObjectHash,
                        llvm::StringRef objectFile);
 
+/// With -cache-template-instances, returns whether an object file recorded in
+/// the cache directory defines the template instance `mangle`.
+bool isTemplateInstanceCached(llvm::StringRef mangle);
+/// With -cache-template-instances, records the template instances defined in
+/// `m` for `objectFile` in the cache directory, and for the cached object file
+/// `cacheObjectHash` if not empty.
+void recordTemplateInstances(llvm::Module &m, llvm::StringRef objectFile,
+                             llvm::StringRef cacheObjectHash);
+/// With -cache-template-instances, records the template instances of the
+/// cached object file `cacheObjectHash` for `objectFile`, recovered from it.
+void recoverTemplateInstances(llvm::StringRef cacheObjectHash,
+                              llvm::StringRef objectFile);
+
 /// Prune the cache to avoid filling up disk space.
 void pruneCache();
 }
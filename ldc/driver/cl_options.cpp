@@ -100,7 +100,7 @@ static cl::opt<bool, true>
 // any value.
 using DummyDataType = bool;
 
-// `-vtemplates[=list-instances]` parser.
+// `-vtemplates[=list-instances|lookups]` parser.
 struct VTemplatesParser : public cl::parser<DummyDataType> {
   explicit VTemplatesParser(cl::Option &O) : cl::parser<DummyDataType>(O) {}
 
@@ -117,6 +117,11 @@ struct VTemplatesParser : public cl::parser<DummyDataType> {
       return false;
     }
 
+    if (Arg == "lookups") {
+      global.params.v.templatesLookups = true;
+      return false;
+    }
+
     return O.error("unsupported value '" + Arg + "'");
   }
 };
@@ -125,7 +130,8 @@ static cl::opt<DummyDataType, false, VTemplatesParser> vtemplates(
     "vtemplates", cl::ZeroOrMore, cl::ValueOptional,
     cl::desc("List statistics on template instantiations\n"
              "Use -vtemplates=list-instances to additionally show all "
-             "instantiation contexts for each template"));
+             "instantiation contexts for each template, or "
+             "-vtemplates=lookups to show the cost of instance lookups"));
 
 static cl::opt<bool, true> verbose_cg("v-cg", cl::desc("Verbose codegen"),
                                       cl::ZeroOrMore,
@@ -135,6 +141,17 @@ static cl::opt<bool, true> verbose_cg_ast("vcg-ast", cl::ZeroOrMore, cl::Hidden,
                                           cl::desc("Write AST to .cg file"),
                                           cl::location(global.params.vcg_ast));
 
+static cl::opt<unsigned, true>
+    jobs("j", cl::ZeroOrMore, cl::location(global.params.jobs),
+         cl::value_desc("n"),
+         cl::desc("Parse the D source files on the command line on <n> "
+                  "threads (not those found via imports or -i)"));
+
+static cl::opt<bool, true>
+    lazyBodies("lazy-bodies", cl::ZeroOrMore,
+               cl::location(global.params.lazyBodies),
+               cl::desc("Parse function bodies of imported modules on demand"));
+
 static cl::opt<unsigned, true> errorLimit(
     "verrors", cl::ZeroOrMore, cl::location(global.params.v.errorLimit),
     cl::desc("Limit the number of error messages (0 means unlimited)"));
@@ -294,6 +311,10 @@ cl::opt<bool>
     hdrKeepAllBodies("Hkeep-all-bodies", cl::ZeroOrMore,
                      cl::desc("Keep all function bodies in .di files"));
 
+static cl::opt<bool, true>
+    hdrBinary("Hb", cl::ZeroOrMore, cl::location(global.params.binaryHeaders),
+              cl::desc("Write binary .dio 'header' file (experimental)"));
+
 // C++ header generation options
 
 // `-HC[=silent|verbose]` parser. Required for defaulting to `silent`.
@@ -527,6 +548,11 @@ static cl::opt<LinkonceTemplates, true> linkonceTemplates(
                    "linkonce-templates-aggressive",
                    "Experimental, more aggressive variant")));
 
+cl::opt<bool> hashTemplateSymbols(
+    "hash-template-symbols", cl::ZeroOrMore,
+    cl::desc("With -linkonce-templates, hash the names of all instantiated "
+             "functions regardless of -hash-threshold (experimental)"));
+
 cl::opt<bool> disableLinkerStripDead(
     "disable-linker-strip-dead", cl::ZeroOrMore,
     cl::desc("Do not try to remove unused symbols during linking"),
@@ -585,6 +611,11 @@ cl::opt<bool>
     fSplitStack("fsplit-stack", cl::ZeroOrMore,
                 cl::desc("Use segmented stack (see Clang documentation)"));
 
+cl::opt<bool> safepoints(
+    "safepoints", cl::ZeroOrMore,
+    cl::desc("Poll for GC safepoints at function entry and loop heads, "
+             "letting the GC stop threads without signals"));
+
 cl::opt<bool, true>
     allinst("allinst", cl::ZeroOrMore, cl::location(global.params.allInst),
             cl::desc("Generate code for all template instantiations"));
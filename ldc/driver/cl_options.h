@@ -88,6 +88,7 @@ enum class SymbolVisibility { default_, hidden, public_ };
 extern cl::opt<SymbolVisibility> symbolVisibility;
 extern cl::opt<DLLImport, true> dllimport;
 extern cl::opt<bool> noPLT;
+extern cl::opt<bool> hashTemplateSymbols;
 extern cl::opt<bool> useDIP25;
 extern cl::opt<bool> useDIP1000;
 
@@ -104,6 +105,7 @@ extern cl::opt<bool> fNoExceptions;
 extern cl::opt<bool> fNoModuleInfo;
 extern cl::opt<bool> fNoRTTI;
 extern cl::opt<bool> fSplitStack;
+extern cl::opt<bool> safepoints;
 
 // Arguments to -d-debug
 extern std::vector<std::string> debugArgs;
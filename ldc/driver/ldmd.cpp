@@ -191,6 +191,7 @@ Where:\n\
 "  -H                generate 'header' file\n\
   -Hd=<directory>   write 'header' file to directory\n\
   -Hf=<filename>    write 'header' file to filename\n\
+  -Hb               write binary 'header' file (experimental)\n\
   -HC[=[silent|verbose]]\n\
                     generate C++ 'header' file\n"
 #if 0
@@ -204,6 +205,8 @@ Where:\n\
   -ignore           ignore unsupported pragmas\n\
   -inline           do function inlining\n\
   -J=<directory>    look for string imports also in directory\n\
+  -j=<n>            parse the command line source files on n threads\n\
+  -lazy-bodies      parse function bodies of imported modules on demand\n\
   -L=<linkerflag>   pass linkerflag to link\n\
   -lib              generate library rather than object files\n\
   -lowmem           enable garbage collection for the compiler\n\
@@ -272,7 +275,7 @@ Where:\n\
   -version=<level>  compile in version code >= level\n\
   -version=<ident>  compile in version code identified by ident\n\
   -vgc              list all gc allocations including hidden ones\n\
-  -vtemplates=[list-instances]\n\
+  -vtemplates=[list-instances|lookups]\n\
                     list statistics on template instantiations\n\
   -vtls             list all variables going into thread local storage\n\
   -w                warnings as errors (compilation will halt)\n\
@@ -616,6 +619,7 @@ void translateArgs(const llvm::SmallVectorImpl<const char *> &ldmdArgs,
        * -H
        * -Hd
        * -Hf
+       * -Hb
        * -X
        * -Xf
        * -ignore
@@ -657,6 +661,8 @@ void translateArgs(const llvm::SmallVectorImpl<const char *> &ldmdArgs,
       /* -unittest
        * -I
        * -J
+       * -j
+       * -lazy-bodies
        */
       else if (startsWith(p + 1, "debug") && p[6] != 'l') {
         // Parse:
@@ -360,8 +360,13 @@ void parseCommandLine(Strings &sourceFiles) {
 
   global.params.dihdr.dir = opts::fromPathString(hdrDir);
   global.params.dihdr.name = opts::fromPathString(hdrFile);
-  global.params.dihdr.doOutput |=
-      global.params.dihdr.dir.length || global.params.dihdr.name.length;
+  global.params.dihdr.doOutput |= global.params.dihdr.dir.length ||
+                                  global.params.dihdr.name.length ||
+                                  global.params.binaryHeaders;
+  if (global.params.binaryHeaders && !hdrFile.empty() &&
+      llvm::sys::path::extension(hdrFile) != ".dio") {
+    error(Loc(), "-Hf file name must have the .dio extension with -Hb");
+  }
 
   global.params.cxxhdr.dir = opts::fromPathString(cxxHdrDir);
   global.params.cxxhdr.name = opts::fromPathString(cxxHdrFile);
@@ -1313,6 +1318,11 @@ void codegenModules(Modules &modules) {
       }
       if (global.errors)
         fatal();
+
+      // modules[0..i] are still to be emitted, and DCompute device modules
+      // are only emitted after all host modules.
+      if (computeModules.empty())
+        m->releaseBodies(DArray<Module *>(i, modules.tdata()));
     }
 
     if (!computeModules.empty()) {
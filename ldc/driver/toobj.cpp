@@ -346,6 +346,7 @@ void writeModule(llvm::Module *m, const char *filename) {
     std::string cacheFile = cache::cacheLookup(moduleHash);
     if (!cacheFile.empty()) {
       cache::recoverObjectFile(moduleHash, filename);
+      cache::recoverTemplateInstances(moduleHash, filename);
       return;
     }
   }
@@ -488,5 +489,6 @@ void writeModule(llvm::Module *m, const char *filename) {
     if (useIR2ObjCache) {
       cache::cacheObjectFile(filename, moduleHash);
     }
+    cache::recordTemplateInstances(*m, filename, moduleHash);
   }
 }
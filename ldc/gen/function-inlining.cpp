@@ -63,6 +63,7 @@ bool isInlineCandidate(FuncDeclaration &fdecl) {
   unsigned statementThreshold = 10;
   MoreThanXStatements statementCounter(statementThreshold);
   RecursiveWalker walker(&statementCounter, false);
+  fdecl.parseLazyBody();
   fdecl.fbody->accept(&walker);
 
   IF_LOG Logger::println("Contains %u statements or more (threshold = %u).",
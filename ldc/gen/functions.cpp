@@ -22,6 +22,7 @@
 #include "dmd/statement.h"
 #include "dmd/target.h"
 #include "dmd/template.h"
+#include "driver/cache.h"
 #include "driver/cl_options.h"
 #include "driver/cl_options_instrumentation.h"
 #include "driver/cl_options_sanitizers.h"
@@ -1013,6 +1014,17 @@ void emulateWeakAnyLinkageForMSVC(IrFunction *irFunc, LINK linkage) {
   func->replaceNonMetadataUsesWith(newFunc);
 }
 
+/// With -cache-template-instances, returns whether another object file of the
+/// build already defines the template instance `fd`.
+bool isDefinedByOtherObject(FuncDeclaration *fd, llvm::Function *func) {
+  // Function literals are numbered per compilation, and module constructors
+  // are run by the ModuleInfo of the module that defines them.
+  return fd->isInstantiated() && !fd->isFuncLiteralDeclaration() &&
+         !fd->isStaticCtorDeclaration() && !fd->isStaticDtorDeclaration() &&
+         !fd->isUnitTestDeclaration() && !hasWeakUDA(fd) &&
+         cache::isTemplateInstanceCached(func->getName());
+}
+
 } // anonymous namespace
 
 void DtoDefineFunction(FuncDeclaration *fd, bool linkageAvailableExternally) {
@@ -1038,7 +1050,8 @@ void DtoDefineFunction(FuncDeclaration *fd, bool linkageAvailableExternally) {
     llvm::Function *func = getIrFunc(fd)->getLLVMFunc();
     assert(func);
     if (!linkageAvailableExternally &&
-        (func->getLinkage() == llvm::GlobalValue::AvailableExternallyLinkage)) {
+        (func->getLinkage() == llvm::GlobalValue::AvailableExternallyLinkage) &&
+        !isDefinedByOtherObject(fd, func)) {
       // Fix linkage and visibility
       const auto lwc = lowerFuncLinkage(fd);
       setLinkage(lwc, func);
@@ -1165,6 +1178,17 @@ void DtoDefineFunction(FuncDeclaration *fd, bool linkageAvailableExternally) {
     return;
   }
 
+  if (!linkageAvailableExternally && !fd->isNaked() &&
+      isDefinedByOtherObject(fd, func)) {
+    if (fd->inlining != PINLINE::always && !willCrossModuleInline()) {
+      IF_LOG Logger::println("Defined by another object file, skipping.");
+      return;
+    }
+    IF_LOG Logger::println(
+        "Defined by another object file, emitting available_externally.");
+    linkageAvailableExternally = true;
+  }
+
   gIR->funcGenStates.emplace_back(new FuncGenState(*irFunc, *gIR));
   auto &funcGen = gIR->funcGen();
   SCOPE_EXIT {
@@ -1353,6 +1377,9 @@ void DtoDefineFunction(FuncDeclaration *fd, bool linkageAvailableExternally) {
   funcGen.pgo.emitCounterIncrement(fd->fbody);
   funcGen.pgo.setCurrentStmt(fd->fbody);
 
+  // recursion without loops must reach safepoints too
+  DtoSafepointPoll();
+
   // output function body
   Statement_toIR(fd->fbody, gIR);
 
@@ -20,6 +20,7 @@
 #include "ir/iraggr.h"
 #include "ir/irvar.h"
 #include "llvm/ADT/DenseMap.h"
+#include "llvm/ADT/SmallPtrSet.h"
 #include "llvm/ADT/StringMap.h"
 #include "llvm/ProfileData/InstrProfReader.h"
 #include <deque>
@@ -220,6 +221,10 @@ public:
   // eliminated.
   std::vector<LLConstant *> usedArray;
 
+  // Thread-local globals defined for D variables whose type has no pointers,
+  // see the MItlsNoScan ModuleInfo flag.
+  llvm::SmallPtrSet<llvm::GlobalVariable *, 16> pointerFreeTLSGlobals;
+
   /// Whether to emit array bounds checking in the current function.
   bool emitArrayBoundsChecks();
 
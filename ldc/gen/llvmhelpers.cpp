@@ -17,6 +17,7 @@
 #include "dmd/init.h"
 #include "dmd/module.h"
 #include "dmd/template.h"
+#include "driver/cl_options.h"
 #include "gen/abi/abi.h"
 #include "gen/arrays.h"
 #include "gen/classes.h"
@@ -40,6 +41,7 @@
 #include "ir/irmodule.h"
 #include "ir/irtypeaggr.h"
 #include "ir/irtypeclass.h"
+#include "llvm/IR/MDBuilder.h"
 #include "llvm/MC/MCAsmInfo.h"
 #include "llvm/Support/CommandLine.h"
 #include "llvm/Support/ManagedStatic.h"
@@ -342,6 +344,43 @@ void DtoThrow(const Loc &loc, DValue *e) {
   gIR->ir->SetInsertPoint(bb);
 }
 
+/******************************************************************************
+ * SAFEPOINT POLL
+ ******************************************************************************/
+
+/// Loads druntime's _d_safepointRequested flag and calls _d_safepoint() if it
+/// is set (see core.thread.osthread). The load is a relaxed atomic one; the
+/// GC's store reaches running threads through cache coherence, no barrier is
+/// needed for a thread to see it eventually. Threads that don't poll in time
+/// are suspended with a signal.
+void DtoSafepointPoll() {
+  if (!opts::safepoints || gIR->scopereturned())
+    return;
+  // the slow path itself must not poll
+  if (gIR->topfunc()->getName() == "_d_safepoint")
+    return;
+
+  auto &module = gIR->module;
+  auto i32Ty = LLType::getInt32Ty(gIR->context());
+  auto flag = declareGlobal(Loc(), module, i32Ty, "_d_safepointRequested",
+                            /*isConstant=*/false, /*isThreadLocal=*/false,
+                            global.params.dllimport != DLLImport::none);
+  auto requested = gIR->ir->CreateAlignedLoad(i32Ty, flag, llvm::MaybeAlign(4),
+                                              /*isVolatile=*/false);
+  requested->setAtomic(llvm::AtomicOrdering::Monotonic);
+
+  llvm::BasicBlock *pollbb = gIR->insertBB("safepoint");
+  llvm::BasicBlock *contbb = gIR->insertBBAfter(pollbb, "safepoint.cont");
+  llvm::MDBuilder mdBuilder(gIR->context());
+  gIR->ir->CreateCondBr(gIR->ir->CreateIsNotNull(requested), pollbb, contbb,
+                        mdBuilder.createBranchWeights(1, 1 << 20));
+
+  gIR->ir->SetInsertPoint(pollbb);
+  gIR->ir->CreateCall(getRuntimeFunction(Loc(), module, "_d_safepoint"), {});
+  gIR->ir->CreateBr(contbb);
+  gIR->ir->SetInsertPoint(contbb);
+}
+
 /******************************************************************************
  * MODULE FILE NAME
  ******************************************************************************/
@@ -63,6 +63,9 @@ void DtoCAssert(Module *M, const Loc &loc, LLValue *msg);
 
 void DtoThrow(const Loc &loc, DValue *e);
 
+/// With -safepoints, emits a poll stopping the thread for the GC if requested.
+void DtoSafepointPoll();
+
 // returns module file name
 LLConstant *DtoModuleFileName(Module *M, const Loc &loc);
 
@@ -18,6 +18,7 @@
 #include "dmd/identifier.h"
 #include "dmd/mangle.h"
 #include "dmd/module.h"
+#include "driver/cl_options.h"
 #include "gen/abi/abi.h"
 #include "gen/irstate.h"
 #include "gen/to_string.h"
@@ -57,14 +58,16 @@ std::string hashSymbolName(llvm::StringRef name, Dsymbol *symb) {
 
   // module
   {
-    auto moddecl = symb->getModule()->md;
-    assert(moddecl);
-    for (size_t i = 0; i < moddecl->packages.length; ++i) {
-      llvm::StringRef str = moddecl->packages.ptr[i]->toChars();
-      ret += ldc::to_string(str.size());
-      ret += str;
+    auto module = symb->getModule();
+    // modules without a module declaration are named after their file
+    if (auto moddecl = module->md) {
+      for (size_t i = 0; i < moddecl->packages.length; ++i) {
+        llvm::StringRef str = moddecl->packages.ptr[i]->toChars();
+        ret += ldc::to_string(str.size());
+        ret += str;
+      }
     }
-    llvm::StringRef str = moddecl->id->toChars();
+    llvm::StringRef str = module->ident->toChars();
     ret += ldc::to_string(str.size());
     ret += str;
   }
@@ -94,6 +97,15 @@ std::string hashSymbolName(llvm::StringRef name, Dsymbol *symb) {
 
   return ret;
 }
+
+/// With -linkonce-templates, each object file defines the instantiated
+/// functions it references, so their names can be hashed regardless of their
+/// length without breaking references across object files.
+bool shouldHashTemplateSymbol(FuncDeclaration *fdecl) {
+  return opts::hashTemplateSymbols &&
+         global.params.linkonceTemplates != LinkonceTemplates::no &&
+         !fdecl->mangleOverride.length && fdecl->isInstantiated();
+}
 }
 
 std::string getIRMangledName(FuncDeclaration *fdecl, LINK link) {
@@ -104,8 +116,9 @@ std::string getIRMangledName(FuncDeclaration *fdecl, LINK link) {
 
   // Hash the name if necessary
   if (((link == LINK::d) || (link == LINK::default_)) &&
-      (global.params.hashThreshold != 0) &&
-      (mangledName.length() > global.params.hashThreshold)) {
+      (shouldHashTemplateSymbol(fdecl) ||
+       ((global.params.hashThreshold != 0) &&
+        (mangledName.length() > global.params.hashThreshold)))) {
 
     auto hashedName = hashSymbolName(mangledName, fdecl);
     mangledName = "_D" + hashedName + "Z";
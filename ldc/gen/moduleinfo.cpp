@@ -35,6 +35,7 @@
 #define MIunitTest 0x200
 #define MIimportedModules 0x400
 #define MIlocalClasses 0x800
+#define MItlsNoScan 0x2000
 #define MInew 0x80000000 // it's the "new" layout
 
 namespace {
@@ -193,6 +194,19 @@ llvm::Constant *buildLocalClasses(Module *m, size_t &count) {
   const auto type = llvm::ArrayType::get(classinfoTy, classInfoRefs.size());
   return LLConstantArray::get(type, classInfoRefs);
 }
+
+/// Checks whether all thread-local globals defined in the current llvm::Module
+/// so far are D variables without pointers. Anything else (e.g. TLS emitted
+/// for other purposes) makes the GC scan the TLS block conservatively.
+bool hasPointerFreeTLS() {
+  for (auto &gvar : gIR->module.globals()) {
+    if (gvar.isThreadLocal() && !gvar.isDeclaration() &&
+        !gIR->pointerFreeTLSGlobals.count(&gvar)) {
+      return false;
+    }
+  }
+  return true;
+}
 }
 
 llvm::GlobalVariable *genModuleInfo(Module *m) {
@@ -263,6 +277,10 @@ llvm::GlobalVariable *genModuleInfo(Module *m) {
     flags |= MIstandalone;
   }
 
+  if (hasPointerFreeTLS()) {
+    flags |= MItlsNoScan;
+  }
+
   // Now, start building the initialiser for the ModuleInfo instance.
   RTTIBuilder b(moduleInfoType);
 
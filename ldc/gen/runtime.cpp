@@ -756,6 +756,9 @@ static void buildRuntimeModule() {
   createFwdDecl(LINK::c, voidTy, {"_d_throw_exception"}, {throwableTy}, {},
                 Attr_Cold_NoReturn);
 
+  // void _d_safepoint()
+  createFwdDecl(LINK::c, voidTy, {"_d_safepoint"}, {}, {}, Attr_NoUnwind);
+
   //////////////////////////////////////////////////////////////////////////////
   //////////////////////////////////////////////////////////////////////////////
   //////////////////////////////////////////////////////////////////////////////
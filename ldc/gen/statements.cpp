@@ -531,6 +531,7 @@ public:
 
     // replace current scope
     irs->ir->SetInsertPoint(whilebb);
+    DtoSafepointPoll();
 
     // create the condition
     emitCoverageLinecountInc(stmt->condition->loc);
@@ -606,6 +607,7 @@ public:
     // branch to condition block
     llvm::BranchInst::Create(condbb, irs->scopebb());
     irs->ir->SetInsertPoint(condbb);
+    DtoSafepointPoll();
 
     // create the condition
     emitCoverageLinecountInc(stmt->condition->loc);
@@ -672,6 +674,7 @@ public:
 
     // replace current scope
     irs->ir->SetInsertPoint(forbb);
+    DtoSafepointPoll();
 
     // create the condition
     llvm::Value *cond_val;
@@ -1355,6 +1358,7 @@ public:
 
     // condition
     irs->ir->SetInsertPoint(condbb);
+    DtoSafepointPoll();
 
     LLValue *done = nullptr;
     LLValue *load = DtoLoad(keytype, keyvar);
@@ -1459,6 +1463,7 @@ public:
 
     // CONDITION
     irs->ir->SetInsertPoint(condbb);
+    DtoSafepointPoll();
 
     // first we test that lwr < upr
     lower = DtoLoad(keytype, keyval);
@@ -141,6 +141,9 @@ void IrGlobal::define() {
   auto gvar = llvm::cast<LLGlobalVariable>(value);
   value = gIR->setGlobalVarInitializer(gvar, initVal, V);
 
+  if (V->isThreadlocal() && !hasPointers(V->type))
+    gIR->pointerFreeTLSGlobals.insert(gvar);
+
   // dllexport isn't supported for thread-local globals (MSVC++ neither);
   // don't let LLVM create a useless /EXPORT directive (yields the same linker
   // error anyway when trying to dllimport).